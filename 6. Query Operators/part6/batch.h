@@ -0,0 +1,76 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "catalog.h"
+
+
+// # of tuples in the batches operators exchange, or 0 if they hand
+// each other one tuple at a time (minirel's batch size argument)
+extern int BatchSize;
+
+
+// A batch of tuples stored by column: the value of attribute i of
+// tuple k is at column(i) + k * attrLen. Of the cnt tuples of the
+// batch only the selected ones, sel[0..selCnt-1] in increasing order,
+// belong to the result; a filter selects tuples without moving them.
+// The columns have room for the BatchSize tuples at construction.
+//
+// Only the columns in use are filled. All are at construction; an
+// operator that reads only some columns of the batches of its input
+// takes the others out of use, so that the operators below it do not
+// copy them.
+
+class Batch
+{
+public:
+    Batch(const int attrCnt, const AttrDesc attrs[]);
+    ~Batch();
+
+    int capacity() const { return size; }
+    char *column(const int i) const { return columns[i]; }
+
+    bool used(const int i) const { return inUse[i]; }
+    void use(const int i, const bool u) { inUse[i] = u; }
+
+    // copy the n tuples t[], with the attributes of the batch, to rows
+    // k.. of the columns in use, one column at a time
+    void decode(const int k, const char * const t[], const int n);
+
+    // select all cnt tuples
+    void selectAll();
+
+    // copy the selected tuples, one column at a time, to the rows of
+    // tuple length that rows holds
+    void encode(char *rows) const;
+
+    int cnt;                            // # of tuples
+    int selCnt;                         // # of selected tuples
+    int *sel;                           // their numbers
+
+private:
+    int colCnt;
+    int *lens;                          // attrLen of each column
+    int *offsets;                       // attrOffset of each column
+    char **columns;
+    bool *inUse;
+    int size;
+};
+
+
+// copy values sel[0..n-1] of column from, of length len, to values
+// 0..n-1 of column to
+void gatherValues(char *to, const char *from, const int len,
+                  const int *sel, const int n);
+
+
+// Selection kernels: the numbers in sel[0..n-1] of the values in
+// column, of attribute attr, that satisfy op with value (a value of
+// attr, or another column of it if isColumn), written to out, which
+// may be sel. dense says that sel is 0..n-1; INTEGER and FLOAT values
+// of a dense selection are compared four at a time by SSE2 if the
+// compiler targets it. Returns the number of values written.
+int selectValues(const char *column, const AttrDesc & attr,
+                 const Operator op, const char *value, const bool isColumn,
+                 const int *sel, const int n, const bool dense, int *out);
+
+#endif
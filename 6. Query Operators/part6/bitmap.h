@@ -0,0 +1,62 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <vector>
+using namespace std;
+
+
+// A word-aligned hybrid (WAH) compressed bitmap. Bits are grouped
+// into 31-bit groups, and each 32-bit word holds either
+//
+//   a literal:  MSB 0, the 31 bits of one group
+//   a fill:     MSB 1, bit 30 the fill value, low 30 bits the number
+//               of consecutive groups that are all 0s or all 1s
+//
+// The last group may be partial; it is kept apart in active until it
+// is complete. Logical operations work directly on the compressed
+// words, so long runs of 0s cost a single word.
+
+class WAHBitmap {
+ public:
+  WAHBitmap();
+
+  const int size() const { return nbits; }  // # of bits covered
+  const int count() const;              // # of bits set
+
+  void set(const int pos);              // set bit pos to 1
+  void clear(const int pos);            // set bit pos to 0
+  const bool test(const int pos) const;
+
+  // positions of all set bits in increasing order
+  void positions(vector<int> & out) const;
+
+  // bitwise AND / OR of two bitmaps
+  static void AND(const WAHBitmap & b1, const WAHBitmap & b2,
+		  WAHBitmap & result);
+  static void OR(const WAHBitmap & b1, const WAHBitmap & b2,
+		 WAHBitmap & result);
+
+  // # of bytes serialize() needs, and conversion to and from bytes
+  const int serializedLen() const;
+  void serialize(char *buf) const;
+  void deserialize(const char *buf);
+
+  const int wordCnt() const { return words.size(); }
+
+ private:
+  vector<unsigned int> words;           // complete groups
+  unsigned int active;                  // bits of the partial last group
+  int activeBits;                       // # of bits in the partial group
+  int nbits;                            // total # of bits covered
+
+  void appendGroup(const unsigned int literal);
+  void appendFill(const bool bit, const int groups);
+  void finish(const int size);
+  void change(const int pos, const bool bit);
+  void mergeFills(const unsigned int i);
+
+  static void combine(const WAHBitmap & b1, const WAHBitmap & b2,
+		      const bool isAnd, WAHBitmap & result);
+};
+
+#endif
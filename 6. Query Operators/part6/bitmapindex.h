@@ -0,0 +1,125 @@
+#ifndef BITMAPINDEX_H
+#define BITMAPINDEX_H
+
+#include <vector>
+#include "catalog.h"
+#include "bitmap.h"
+
+
+// define if debug output wanted
+//#define DEBUGBITMAP
+
+
+// A RID is mapped to bit pageNo * BITMAPSLOTS + slotNo of a bitmap.
+// No page can hold more slots than this.
+
+const int BITMAPSLOTS = PAGESIZE / sizeof(slot_t);
+
+inline int RIDToBit(const RID & rid)
+{
+  return rid.pageNo * BITMAPSLOTS + rid.slotNo;
+}
+
+inline RID BitToRID(const int bit)
+{
+  RID rid;
+  rid.pageNo = bit / BITMAPSLOTS;
+  rid.slotNo = bit % BITMAPSLOTS;
+  return rid;
+}
+
+
+// Header page of a bitmap index file. It is the first page of the
+// file and stays pinned in the buffer pool while the index is open.
+
+struct BitmapHdrPage
+{
+  char relName[MAXNAME];                // name of indexed relation
+  char attrName[MAXNAME];               // name of key attribute
+  int  attrOffset;                      // offset of key in tuples
+  int  attrType;                        // INTEGER, FLOAT, or STRING
+  int  attrLen;                         // length of key in bytes
+  int  valueCnt;                        // # of distinct key values
+  int  entryCnt;                        // # of indexed tuples
+  int  dirPageNo;                       // first page of the directory
+  int  dirLen;                          // # of bytes of the directory
+};
+
+
+// The directory and each bitmap are byte streams, each spread over
+// its own chain of pages that start with a BitmapDataHdr. The
+// directory holds, for each distinct value in key order, the key
+// (attrLen bytes) followed by a BitmapDirEntry locating the
+// serialized WAHBitmap of the tuples having that value, so that a
+// change to one value reads and writes the pages of that bitmap only.
+
+struct BitmapDataHdr
+{
+  int next;                             // next page of the chain, or -1
+};
+
+struct BitmapDirEntry
+{
+  int pageNo;                           // first page of the bitmap
+  int len;                              // # of bytes of the bitmap
+};
+
+
+// A bitmap index on a single INTEGER, FLOAT, or STRING attribute.
+// It keeps one WAH-compressed bitmap per distinct value, so it suits
+// attributes with few distinct values. Bitmaps of several values,
+// or of several indexes on the same relation, can be combined with
+// WAHBitmap::AND and OR before any tuple is read.
+//
+// The directory is read into memory when the index is opened. A
+// bitmap is read when a value is first looked up or changed, and the
+// changed bitmaps are written back when the index is closed.
+
+class BitmapIndex {
+ public:
+  BitmapIndex(const string & fileName, Status & status);  // open index
+  ~BitmapIndex();                       // write bitmaps and close file
+
+  // set the bit of tuple rid in the bitmap of value key
+  const Status insertEntry(const char *key, const RID & rid);
+
+  // clear it again; RECNOTFOUND if it was not set
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // OR of the bitmaps of all values v for which "v op value" holds
+  const Status getBitmap(const char *value, const Operator op,
+			 WAHBitmap & result);
+
+  const int getValueCnt() const { return keys.size(); }
+  const int getEntryCnt() const { return headerPage->entryCnt; }
+  const int getWordCnt();               // # of compressed words in all bitmaps
+
+ private:
+  File*          filePtr;               // underlying DB File object
+  BitmapHdrPage* headerPage;            // pinned header page
+  int            headerPageNo;          // page number of header page
+  bool           hdrDirtyFlag;          // true if header was updated
+  bool           dirDirtyFlag;          // true if directory changed
+
+  int            keyLen;                // length of key
+  vector<string> keys;                  // distinct values, in key order
+  vector<BitmapDirEntry> entries;       // where each bitmap is stored
+  vector<WAHBitmap> bitmaps;            // bitmap of each value, if read
+  vector<bool>   loaded;                // true if bitmaps[i] was read
+  vector<bool>   changed;               // true if bitmaps[i] was changed
+
+  int keycmp(const char *k1, const char *k2) const;
+  const int findKey(const char *key) const;
+  const Status load(const int i);
+  const Status readChain(int pageNo, const int len, vector<char> & data);
+  const Status writeChain(int & firstNo, const vector<char> & data);
+  const Status readDirectory();
+  const Status writeBack();
+};
+
+
+// create an empty bitmap index file
+const Status createBitmapFile(const string & fileName,
+			      const AttrDesc & attrDesc);
+
+#endif
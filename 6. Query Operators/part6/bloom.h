@@ -0,0 +1,41 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "catalog.h"
+
+
+// A Bloom filter on the values of a join attribute, for dropping the
+// tuples of one join relation that cannot match any tuple of the
+// other before they are partitioned or probed. It is blocked: each
+// value sets BLOOMHASHES bits of a single 64-bit word, so that a test
+// touches one cache line. Values are hashed in normalized form
+// (keysort.h), so the filter can be built on the attribute of one
+// relation and tested with the attribute of the other, as long as
+// both have the same type and length.
+//
+// With 16 bits per value about 1 in 200 values that were not added
+// pass the test.
+
+class BloomFilter {
+ public:
+  // room for about n values of attributes like attr
+  BloomFilter(const int n, const AttrDesc & attr);
+  ~BloomFilter();
+
+  void add(const char* attrPtr);
+
+  // false if the value at attrPtr was never added
+  const bool test(const char* attrPtr) const;
+
+ private:
+  unsigned long long* words;
+  unsigned int wordCnt;
+  int length;                           // of attribute values
+  Datatype type;
+
+  // the word and the bits in it of the value at attrPtr
+  void locate(const char* attrPtr, unsigned int & word,
+	      unsigned long long & bits) const;
+};
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGBTREE
+
+
+// Percentage of each node that bulk loading fills when no fill
+// factor is given. The slack absorbs later inserts without splits.
+
+const int BTREEFILLFACTOR = 90;
+
+// Most attributes that can be included in the leaf entries of a
+// covering index.
+
+const int BTMAXINCLUDE = 8;
+
+class SortedFile;
+
+
+// An attribute of the relation whose value is stored in every leaf
+// entry next to the key.
+
+struct BTInclAttr
+{
+  char attrName[MAXNAME];               // name of included attribute
+  int  attrOffset;                      // offset in tuples
+  int  attrLen;                         // length in bytes
+};
+
+
+// Header page of a B+-tree index file. It is the first page of the
+// file and stays pinned in the buffer pool while the index is open.
+
+struct BTreeHdrPage
+{
+  char relName[MAXNAME];                // name of indexed relation
+  char attrName[MAXNAME];               // name of key attribute
+  int  attrOffset;                      // offset of key in tuples
+  int  attrType;                        // INTEGER, FLOAT, or STRING
+  int  attrLen;                         // length of key in bytes
+  int  rootPageNo;                      // page number of root node
+  int  height;                          // # of levels (1 = root is a leaf)
+  int  entryCnt;                        // # of (key, RID) entries
+  int  leafCnt;                         // # of leaf pages
+  int  inclCnt;                         // # of included attributes
+  int  inclLen;                         // total length of included attributes
+  BTInclAttr incl[BTMAXINCLUDE];        // included attributes
+};
+
+
+// Every node page of the tree starts with a BTNodeHdr. Leaf nodes
+// (level 0) hold (key, RID, included values) entries sorted on key
+// and then on RID, so that duplicate keys still give every entry a
+// unique position.
+// Inner nodes hold (key, RID, child) entries; link is the leftmost
+// child, which covers everything smaller than the first entry, and
+// the child of entry i covers everything from entry i up to entry
+// i+1. Leaves are chained left to right through link.
+
+struct BTNodeHdr
+{
+  int level;                            // 0 for leaf nodes
+  int keyCnt;                           // # of entries on the page
+  int link;                             // next leaf / leftmost child
+};
+
+
+// A disk-resident B+-tree on a single INTEGER, FLOAT, or STRING
+// attribute of a relation, mapping key values to RIDs. All pages are
+// accessed through the buffer manager. Deletions are lazy: entries
+// are removed from their leaf but nodes are never merged, so the
+// tree only shrinks when it is rebuilt.
+//
+// A covering index also stores the values of some other attributes
+// (the included attributes) in its leaf entries. A query that needs
+// only the key and included attributes can then be answered from
+// the leaves without reading the relation.
+
+class BTreeIndex {
+ public:
+  BTreeIndex(const string & fileName, Status & status);  // open index
+  ~BTreeIndex();                        // unpin pages and close file
+
+  // add an entry for the tuple with key value key and id rid; the
+  // included values are copied from tuple, which may be NULL if the
+  // index has no included attributes
+  const Status insertEntry(const char *key, const RID & rid,
+			   const char *tuple);
+
+  // remove the entry for (key, rid); RECNOTFOUND if there is none
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // Build the tree bottom-up from a stream of leaf entries
+  // sorted on key, filling nodes to fillFactor percent. The tree
+  // must be empty.
+  const Status bulkLoad(SortedFile & entries, const int fillFactor);
+
+  // Start a range scan. lowOp must be GT or GTE and highOp LT or LTE;
+  // a NULL value leaves that end of the range open.
+  const Status startScan(const char *lowVal, const Operator lowOp,
+			 const char *highVal, const Operator highOp);
+
+  // return RID of next entry in the range, FILEEOF at end of range
+  const Status scanNext(RID & outRid);
+
+  // same, but also return the leaf entry, which stays valid until
+  // the scan moves on
+  const Status scanNext(RID & outRid, const char* & entry);
+
+  const Status endScan();               // terminate the scan
+
+  // offset of attribute attrName in leaf entries, -1 if it is neither
+  // the key nor an included attribute
+  const int entryOffset(const string & attrName) const;
+
+  const int getEntryCnt() const { return headerPage->entryCnt; }
+  const int getHeight() const { return headerPage->height; }
+  const int getLeafCnt() const { return headerPage->leafCnt; }
+
+ private:
+  File*         filePtr;                // underlying DB File object
+  BTreeHdrPage* headerPage;             // pinned header page
+  int           headerPageNo;           // page number of header page
+  bool          hdrDirtyFlag;           // true if header was updated
+
+  int           keyLen;                 // length of key
+  int           leafLen;                // length of a leaf entry
+  int           inclOffset;             // offset of included values in it
+  int           innerLen;               // length of an inner entry
+  int           leafCap;                // max. # of entries in a leaf
+  int           innerCap;               // max. # of entries in an inner node
+
+  Page*         curPage;                // leaf pinned by current scan
+  int           curPageNo;              // page number of that leaf
+  int           nextEntry;              // next entry to look at on leaf
+  char*         lowVal;                 // copy of low end of scan range
+  Operator      lowOp;
+  char*         highVal;                // copy of high end of scan range
+  Operator      highOp;
+
+  int keycmp(const char *k1, const char *k2) const;
+  int entrycmp(const char *k1, const RID & r1,
+	       const char *k2, const RID & r2) const;
+  int childFor(const char *node, const char *key, const RID *rid,
+	       const bool strict) const;
+
+  const Status insertInto(const int pageNo, const char *key,
+			  const RID & rid, const char *tuple, bool & split,
+			  char *sepKey, RID & sepRid, int & sepChild);
+
+  const Status appendLeaf(Page* & page, int & pageNo, const char *entry,
+			  const int fill, vector<char> & seps);
+  const Status buildLevel(const int level, const int fill,
+			  int & firstChild, vector<char> & seps);
+};
+
+
+// create an empty B+-tree index file on the given attribute, with
+// the values of inclCnt other attributes stored in its leaves
+const Status createBTreeFile(const string & fileName,
+			     const AttrDesc & attrDesc,
+			     const int inclCnt,
+			     const AttrDesc incl[]);
+
+#endif
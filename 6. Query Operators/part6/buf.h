@@ -126,6 +126,8 @@ public:
                         // allocates a new, empty page 
   const Status flushFile(const File* file); // writing out all dirty pages of the file
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
+
+  const int numUnpinnedBufs() const; // # of frames that could be allocated now
   void  printSelf();
 
   const BufStats & getBufStats() const // get buffer pool usage
@@ -70,6 +70,7 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   indexed : integer(4)  (bit mask of IndexType values, see index.h)
 
 
 typedef struct {
@@ -78,6 +79,7 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // kinds of indexes on attribute
 } AttrDesc;
 
 
@@ -107,6 +109,11 @@ class AttrCatalog : public HeapFile {
   // delete all information about a relation
   const Status dropRelation(const string & relation);
 
+  // record the kinds of indexes that exist on an attribute
+  const Status setIndexed(const string & relation,
+			  const string & attrName,
+			  const int indexed);
+
   // close attribute catalog
   ~AttrCatalog();
 };
@@ -115,7 +122,5 @@ class AttrCatalog : public HeapFile {
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
 extern Error error;
-extern Status createHeapFile(const string filename);
-extern Status destroyHeapFile(const string filename);
 
 #endif
@@ -0,0 +1,122 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <vector>
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGHASH
+
+
+// A bucket is split as soon as the average bucket is fuller than this.
+
+const float HASHSPLITLOAD = 0.75;
+
+
+// Header page of a hash index file. It is the first page of the file
+// and stays pinned in the buffer pool while the index is open.
+
+struct HashHdrPage
+{
+  char relName[MAXNAME];                // name of indexed relation
+  char attrName[MAXNAME];               // name of key attribute
+  int  attrOffset;                      // offset of key in tuples
+  int  attrType;                        // INTEGER, FLOAT, or STRING
+  int  attrLen;                         // length of key in bytes
+  int  initBuckets;                     // # of buckets at creation (N)
+  int  level;                           // # of completed doublings
+  int  next;                            // next bucket to be split
+  int  bucketCnt;                       // current # of buckets
+  int  entryCnt;                        // # of (key, RID) entries
+  int  overflowCnt;                     // # of overflow pages
+  int  dirPageNo;                       // first page of bucket directory
+};
+
+
+// The bucket directory maps bucket numbers to the page numbers of
+// the primary bucket pages. It is a chain of pages, each starting
+// with a HashDirHdr followed by cnt page numbers.
+
+struct HashDirHdr
+{
+  int next;                             // next directory page, or -1
+  int cnt;                              // # of page numbers on this page
+};
+
+
+// Every bucket page (primary or overflow) starts with a
+// HashBucketHdr followed by keyCnt unordered (key, RID) entries.
+
+struct HashBucketHdr
+{
+  int keyCnt;                           // # of entries on the page
+  int overflow;                         // next overflow page, or -1
+};
+
+
+// A disk-resident linear hash index on a single INTEGER, FLOAT, or
+// STRING attribute, mapping key values to RIDs. The file starts out
+// with initBuckets buckets; whenever the load exceeds HASHSPLITLOAD
+// the bucket at the split pointer is split in two, so the index grows
+// one bucket at a time and a lookup normally reads a single page.
+// Only equality lookups are supported.
+
+class HashIndex {
+ public:
+  HashIndex(const string & fileName, Status & status);  // open index
+  ~HashIndex();                         // unpin pages and close file
+
+  // add an entry for the tuple with key value key and id rid
+  const Status insertEntry(const char *key, const RID & rid);
+
+  // remove the entry for (key, rid); RECNOTFOUND if there is none
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // start a scan for all entries with key value equal to value
+  const Status startScan(const char *value);
+
+  // return RID of next matching entry, FILEEOF when there are no more
+  const Status scanNext(RID & outRid);
+
+  const Status endScan();               // terminate the scan
+
+  const int getEntryCnt() const { return headerPage->entryCnt; }
+  const int getBucketCnt() const { return headerPage->bucketCnt; }
+  const int getOverflowCnt() const { return headerPage->overflowCnt; }
+
+ private:
+  File*         filePtr;                // underlying DB File object
+  HashHdrPage*  headerPage;             // pinned header page
+  int           headerPageNo;           // page number of header page
+  bool          hdrDirtyFlag;           // true if header was updated
+
+  vector<int>   bucketPages;            // in-memory copy of directory
+  bool          dirDirtyFlag;           // true if directory grew
+
+  int           keyLen;                 // length of key
+  int           entryLen;               // length of an entry
+  int           bucketCap;              // max. # of entries on a page
+
+  Page*         curPage;                // bucket page pinned by scan
+  int           curPageNo;              // page number of that page
+  int           nextEntry;              // next entry to look at on page
+  char*         scanVal;                // copy of the value looked for
+
+  int keycmp(const char *k1, const char *k2) const;
+  const int bucketFor(const char *key) const;
+  const Status placeEntry(const int bucket, const char *entry);
+  const Status splitBucket();
+};
+
+
+// hash value of a key; equal keys (in the sense of keycmp) hash alike
+const unsigned int HashKey(const char *key, const int type, const int len);
+
+
+// create a hash index file with nbuckets empty buckets
+const Status createHashFile(const string & fileName,
+			    const AttrDesc & attrDesc,
+			    const int nbuckets);
+
+#endif
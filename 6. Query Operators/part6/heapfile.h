@@ -58,6 +58,9 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in heap file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
 };
@@ -78,6 +81,12 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // in addition to the filter of startScan, return only records
+    // for which pred(rec, arg) is true; a NULL pred returns all
+    void setPredicate(const bool (*pred)(const Record & rec,
+                                         const void* arg),
+                      const void* arg);
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
@@ -85,6 +94,11 @@ public:
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
 
+    // return the next records that satisfy the scan, at most max of
+    // them, all from the page of the first: their data in recs and
+    // their number in cnt. The last one becomes the current record.
+    const Status scanPage(const char* recs[], const int max, int & cnt);
+
     // read current record, returning pointer and length
     const Status getRecord(Record & rec);
 
@@ -100,6 +114,8 @@ private:
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    const bool (*pred)(const Record & rec, const void* arg);
+    const void* predArg;     // passed to pred
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -125,4 +141,8 @@ public:
     const Status insertRecord(const Record & rec, RID& outRid); 
 };
 
+// create an empty heap file / destroy a heap file
+const Status createHeapFile(const string fileName);
+const Status destroyHeapFile(const string fileName);
+
 #endif
@@ -0,0 +1,71 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+#include "btree.h"
+#include "hashindex.h"
+#include "bitmapindex.h"
+
+
+// Kinds of indexes. The indexed field of an attribute catalog tuple
+// is the bitwise OR of the kinds that exist on the attribute.
+
+enum IndexType { BTREEINDEX = 1, HASHINDEX = 2, BITMAPINDEX = 4 };
+
+
+// name of the file holding an index of the given kind
+const string IX_FileName(const string & relation,
+			 const string & attrName,
+			 const IndexType type);
+
+
+// destroy the files of all indexes on an attribute
+const Status IX_Destroy(const AttrDesc & attrDesc);
+
+
+// RelIndexes opens every index on a relation so that operations
+// which modify the relation can keep the indexes up to date, and so
+// that query operators can find an index on a given attribute.
+
+class RelIndexes {
+ public:
+  RelIndexes(const string & relation, Status & status);
+  ~RelIndexes();                        // close all indexes
+
+  // add entries for a newly inserted tuple to every index; if that
+  // fails, none are added
+  const Status insertEntries(const Record & rec, const RID & rid);
+
+  // remove the entries for a tuple that is about to be deleted; if
+  // that fails, none are removed
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+  // B+-tree on attribute attrName, or NULL if there is none
+  BTreeIndex* getBTree(const string & attrName) const;
+
+  // hash index on attribute attrName, or NULL if there is none
+  HashIndex* getHash(const string & attrName) const;
+
+  // bitmap index on attribute attrName, or NULL if there is none
+  BitmapIndex* getBitmap(const string & attrName) const;
+
+  const bool empty() const { return indexes.empty(); }
+
+ private:
+  typedef struct {
+    AttrDesc attrDesc;                  // catalog entry of key attribute
+    BTreeIndex* btree;                  // open B+-tree, if any
+    HashIndex* hash;                    // open hash index, if any
+    BitmapIndex* bitmap;                // open bitmap index, if any
+  } IXENTRY;
+
+  vector<IXENTRY> indexes;              // one entry per indexed attribute
+
+  const Status changeEntry(const IXENTRY & ix, const int kind,
+			   const Record & rec, const RID & rid,
+			   const bool insert);
+  const Status changeEntries(const Record & rec, const RID & rid,
+			     const bool insert);
+};
+
+#endif
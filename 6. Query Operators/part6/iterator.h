@@ -0,0 +1,441 @@
+#ifndef ITERATOR_H
+#define ITERATOR_H
+
+#include "catalog.h"
+#include "query.h"
+#include "joinHT.h"
+#include "index.h"
+#include "sort.h"
+#include "batch.h"
+
+
+// Query operators as iterators. An operator is opened, asked for its
+// tuples one at a time, and closed, and it asks its inputs for their
+// tuples in turn, so that a tree of operators hands each tuple from
+// the scans at its leaves up to its root as soon as it is made. Only
+// an operator that must see all of its input before it can return a
+// tuple keeps tuples: a sort, and the hash table or blocks of a join.
+// The root's tuples are written to the result by materialize.
+//
+// A tuple next returns stays valid until the next call of next or
+// close. An operator describes its tuples by the catalog entries of
+// their attributes, with attrOffset the offset in its own tuples, so
+// that the operators above it find attributes by name. An operator
+// owns its inputs and deletes them.
+//
+// Unless BatchSize is 0, materialize asks the root for batches of
+// tuples instead (batch.h), which the scans fill by column, filters
+// narrow by selection vectors, and projections and hash joins build a
+// column at a time; the other operators make their batches from the
+// tuples of next. Both ways give the same tuples in the same order.
+
+class Iterator
+{
+public:
+    virtual ~Iterator();
+
+    virtual const Status open() = 0;
+
+    // the next tuple, FILEEOF if there are no more
+    virtual const Status next(const char *& tuple) = 0;
+
+    virtual void close() = 0;
+
+    // the next batch of tuples, with at least one selected, FILEEOF if
+    // there are no more; it stays valid until the next call
+    virtual const Status nextBatch(Batch & batch);
+
+    // a batch for the tuples of the iterator
+    Batch *newBatch() const { return new Batch(attrCnt, attrs); }
+
+    // the heap file whose tuples next returns unchanged, or NULL
+    virtual const char *fileName() const { return NULL; }
+
+    int attrCount() const { return attrCnt; }
+    const AttrDesc & attr(const int i) const { return attrs[i]; }
+    int length() const { return tupleLen; }
+
+    // attribute relName.attrName of the tuples, NULL if there is none
+    const AttrDesc *find(const char *relName, const char *attrName) const;
+
+protected:
+    Iterator();
+
+    // append attribute a, or all attributes of the tuples of input,
+    // to those of the tuples
+    void addAttr(const AttrDesc & a);
+    void addAttrs(const Iterator *input);
+
+    int attrCnt;
+    AttrDesc *attrs;
+    int tupleLen;
+};
+
+
+// A conjunction or a disjunction of comparisons of attributes of a
+// tuple with values, given in the binary form of the attribute, or
+// with other attributes of the tuple.
+
+class Condition
+{
+public:
+    Condition(const bool conjunctive);
+    ~Condition();
+
+    void add(const AttrDesc & attr, const Operator op, const char *value);
+    void add(const AttrDesc & attr1, const Operator op,
+             const AttrDesc & attr2);
+
+    bool empty() const { return comps.empty(); }
+    bool test(const char *tuple) const;
+
+    // find the columns of the attributes in the batches of input, put
+    // them in use in such a batch, and unselect the selected tuples of
+    // it that fail the test
+    void bind(const Iterator *input);
+    void use(Batch & batch) const;
+    void select(Batch & batch) const;
+
+private:
+    struct Comparison
+    {
+        AttrDesc attr1, attr2;
+        Operator op;
+        char *value;                    // NULL if attr2 is compared
+        int col1, col2;                 // columns of attr1 and attr2
+    };
+
+    vector<Comparison> comps;
+    bool conjunctive;
+};
+
+
+// the tuples of a relation
+class ScanIterator : public Iterator
+{
+public:
+    ScanIterator(const string & relation, Status & status);
+    ~ScanIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    const Status nextBatch(Batch & batch);
+    void close();
+    const char *fileName() const { return relName.c_str(); }
+
+private:
+    string relName;
+    HeapFileScan *scan;
+};
+
+
+// The tuples of a relation whose attribute attr satisfies op with a
+// value, found by an index on attr. The value is set before each
+// open, so that a join probes the index with each outer tuple.
+class IndexScanIterator : public Iterator
+{
+public:
+    IndexScanIterator(const AttrDesc & attr, const Operator op,
+                      Status & status);
+    ~IndexScanIterator();
+
+    void setValue(const char *v);
+    const Status open();
+    const Status next(const char *& tuple);
+    void close();
+
+    const AttrDesc & indexAttr() const { return key; }
+
+private:
+    AttrDesc key;
+    Operator op;
+    char *value;
+    BTreeIndex *btree;
+    HashIndex *hash;
+    HeapFile *file;
+    bool scanning;
+};
+
+
+// the tuples of input that satisfy a condition
+class FilterIterator : public Iterator
+{
+public:
+    FilterIterator(Iterator *input, Condition *cond);
+    ~FilterIterator();
+
+    const Status open() { return input->open(); }
+    const Status next(const char *& tuple);
+    const Status nextBatch(Batch & batch);
+    void close() { input->close(); }
+
+private:
+    Iterator *input;
+    Condition *cond;
+};
+
+
+// the attributes proj (of the tuples of input) of the tuples of input
+class ProjectIterator : public Iterator
+{
+public:
+    ProjectIterator(Iterator *input, const int projCnt,
+                    const AttrDesc proj[]);
+    ~ProjectIterator();
+
+    const Status open() { return input->open(); }
+    const Status next(const char *& tuple);
+    const Status nextBatch(Batch & batch);
+    void close() { input->close(); }
+
+private:
+    Iterator *input;
+    int *from;                          // offset of each attribute
+    int *fromColumn;                    // and its column in input
+    char *output;
+    Batch *inputBatch;
+};
+
+
+// the first limit tuples of input
+class LimitIterator : public Iterator
+{
+public:
+    LimitIterator(Iterator *input, const int limit);
+    ~LimitIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    void close() { input->close(); }
+
+private:
+    Iterator *input;
+    int limit;
+    int cnt;
+};
+
+
+// A join: the tuples of outer and inner that match, as the outer
+// tuple followed by the inner one. The subclasses decide which pairs
+// match; other predicates are checked by a filter above the join.
+class JoinIterator : public Iterator
+{
+public:
+    ~JoinIterator();
+
+protected:
+    JoinIterator(Iterator *outer, Iterator *inner);
+
+    void setOuter(const char *t) { memcpy(output, t, outer->length()); }
+    const char *join(const char *t)
+    {
+        memcpy(output + outer->length(), t, inner->length());
+        return output;
+    }
+
+    Iterator *outer, *inner;
+    char *output;
+};
+
+
+// Block nested loops: blocks of outer tuples of at most memBytes are
+// kept in memory, and each block is joined with a scan of inner. The
+// blocks are hashed on outerAttr if the join has an equality
+// outerAttr = innerAttr; otherwise each pair of an outer tuple of the
+// block and an inner tuple matches.
+class BlockJoinIterator : public JoinIterator
+{
+public:
+    BlockJoinIterator(Iterator *outer, Iterator *inner,
+                      const AttrDesc *outerAttr, const AttrDesc *innerAttr,
+                      const int memBytes);
+    ~BlockJoinIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    void close();
+
+protected:
+    const Status nextBlock();           // read the next block of outer
+
+    AttrDesc outerAttr, innerAttr;
+    bool hashed;
+    int memBytes;
+    joinHashTbl *table;                 // the block if it is hashed
+    char *block;                        // or else
+    int blockCnt, blockMax;
+    bool outerDone;                     // all of outer is read
+    bool innerOpen;                     // a block is joined with inner
+    const char *innerTuple;
+    int probe;                          // next tuple of block, -1 if
+                                        // innerTuple is not joined
+};
+
+
+// Hash join: a hash table on innerAttr of the inner tuples, probed
+// with outerAttr of each outer tuple. If the inner tuples take more
+// than memBytes, it joins blocks of outer tuples as BlockJoinIterator
+// instead.
+class HashJoinIterator : public BlockJoinIterator
+{
+public:
+    HashJoinIterator(Iterator *outer, Iterator *inner,
+                     const AttrDesc & outerAttr, const AttrDesc & innerAttr,
+                     const int memBytes);
+
+    ~HashJoinIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    const Status nextBatch(Batch & batch);
+    void close();
+
+private:
+    joinHashTbl *hashTable;             // of the inner tuples
+    bool blocks;                        // joining blocks instead
+    bool probing;                       // an outer tuple is probed
+    int keyColumn;                      // column of outerAttr in outer
+
+    // batches: the batch of outer tuples, the normalized keys and the
+    // hashes of its selected tuples, the next of them to probe, the
+    // tuple being probed, and the pairs of outer tuple number and
+    // inner tuple that match
+    Batch *outerBatch;
+    unsigned char *probeKeys;
+    unsigned int *probeHashes;
+    int outerNext;
+    int probeTuple;
+    int *pairOuter;
+    const char **pairInner;
+};
+
+
+// Index nested loops: each outer tuple sets the value of the index
+// scan inner to its attribute outerAttr, and is joined with the
+// tuples the index finds.
+class IndexJoinIterator : public JoinIterator
+{
+public:
+    IndexJoinIterator(Iterator *outer, IndexScanIterator *inner,
+                      const AttrDesc & outerAttr);
+
+    const Status open();
+    const Status next(const char *& tuple);
+    void close();
+
+private:
+    IndexScanIterator *index;
+    AttrDesc outerAttr;
+    bool innerOpen;
+};
+
+
+// The tuples of input in the order of attribute key (largest first if
+// descending); only the first limit of them if limit is not negative.
+// A small limit keeps the first tuples in a heap during one pass over
+// input. Otherwise input is sorted in memory if it fits in ORDERPAGES
+// pages, and by SortedFile if it does not: from its file if input is
+// a relation, or else from a file that input is written to. The sort
+// is stable. clause names the sort in messages.
+class SortIterator : public Iterator
+{
+public:
+    SortIterator(Iterator *input, const AttrDesc & key,
+                 const bool descending, const int limit,
+                 const char *clause);
+    ~SortIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    void close();
+
+private:
+    enum SortMode {TopNMode, MemoryMode, FileMode};
+
+    const Status topN();
+    const Status sortInput();
+    const Status sortFile(const char *file);
+    void freeSort();
+
+    Iterator *input;
+    AttrDesc key;
+    bool descending;
+    int limit;
+    const char *clause;
+
+    SortMode mode;
+    int cnt;                            // # of tuples returned
+    int total;                          // # of tuples in memory
+    char *tuples;                       // tuples in memory
+    int *order;                         // their numbers in order
+    SortedFile *sorted;
+    string spillName;                   // file input is written to
+};
+
+
+// Aggregates of the groups of tuples of input with equal values of
+// attribute group, which input must be sorted on, or of all tuples
+// of input if group is NULL. Each output attribute i is funcs[i] of
+// attribute args[i] of the group's tuples, or, for NoAgg, attribute
+// args[i] of its first tuple.
+class AggregateIterator : public Iterator
+{
+public:
+    AggregateIterator(Iterator *input, const AttrDesc *group,
+                      const int cnt, const AggFunc funcs[],
+                      const AttrDesc args[], Status & status);
+    ~AggregateIterator();
+
+    const Status open();
+    const Status next(const char *& tuple);
+    void close() { input->close(); }
+
+private:
+    struct Accumulator
+    {
+        AggFunc func;
+        AttrDesc arg;
+        int count;
+        long long isum;
+        double fsum;
+        char *value;                    // MIN and MAX so far
+    };
+
+    void start(const char *t);          // t is a group's first tuple
+    void add(const char *t);
+    void finish();                      // write the group's tuple
+
+    Iterator *input;
+    AttrDesc groupAttr;
+    bool grouped;
+    Accumulator *accs;
+    char *first;                        // first tuple of the group
+    char *output;
+    const char *pending;                // first tuple of the next group
+    bool done;
+    int groupCnt;
+};
+
+
+// write the tuples of plan to relation result
+const Status materialize(Iterator *plan, const string & result,
+                         int & tupCnt);
+
+// The plan of the join of the relations that the joinCnt join
+// predicates, the selCnt selections (a conjunction of them, or a
+// disjunction if conjunctive is false) and the attrCnt attributes
+// attrNames mention, in QU_MultiJoin's order (multijoin.C). Its tuples
+// are those of all the relations, in the order the plan adds them.
+const Status joinPlan(const int attrCnt,
+                      const attrInfo attrNames[],
+                      const int joinCnt,
+                      const attrInfo joinAttrs1[],
+                      const Operator joinOps[],
+                      const attrInfo joinAttrs2[],
+                      const int selCnt,
+                      const attrInfo selAttrs[],
+                      const Operator selOps[],
+                      const bool conjunctive,
+                      Iterator *& plan);
+
+#endif
@@ -1,40 +1,91 @@
+// Hash value of the join attribute value at attrPtr. Values that are
+// equal as the attribute type compares them (-0 and 0, strings that
+// differ after the terminating null only) hash alike; different seeds
+// give independent hash functions.
+unsigned int joinHash(const char* attrPtr, const AttrDesc & attr,
+		      const unsigned int seed);
+
+// The same for a join attribute value in normalized form (keysort.h).
+unsigned int keyHash(const unsigned char* key, const int length,
+		     const unsigned int seed);
+
+
+// An in-memory hash table of the tuples of one side of a join, keyed
+// on the join attribute. Tuples are copied into an arena of large
+// chunks, each preceded by its join attribute in normalized form, so
+// that keys of any type compare with memcmp. The table itself is an
+// open-addressing array of (hash, tuple number) slots with linear
+// probing, kept at most half full; the full hash in each slot rules
+// out almost all other keys without touching their tuples.
+//
+// A probe streams the matching tuples without allocating memory:
+//
+//     for (const char* t = table.lookup(value); t; t = table.next())
+//         ...
+//
+// Only one probe can be in progress at a time.
 
 class joinHashTbl
 {
 private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
+    struct Slot
     {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
+	unsigned int hash;
+	unsigned int entry;         // tuple number + 1, 0 if slot is free
     };
 
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
-    };
+    AttrDesc joinAttr;
+    int tupleLen;
+    int entryLen;               // normalized key + tuple
+    int cnt;                    // # of tuples
+
+    char** chunks;              // the arena
+    int chunkCnt;
+    int chunkShift;             // 2^chunkShift entries per chunk
+
+    Slot* slots;
+    unsigned int mask;          // # of slots - 1
 
-    AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    unsigned char* probeKey;    // normalized key of the current probe
+    unsigned int probeHash;
+    unsigned int probeSlot;     // next slot to look at
+
+    char* entry(const unsigned int n) const  // entry of tuple number n
+    {
+	return chunks[n >> chunkShift]
+	    + (n & ((1u << chunkShift) - 1)) * entryLen;
+    }
+    void grow();                // double the number of slots
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
+    // room for about size tuples of length tupleLen to start with
+    joinHashTbl(const int size, const AttrDesc & attr, const int tupleLen);
     ~joinHashTbl();
 
-     // insert a new (JoinAttrValue, RID) pair into hash table
-     Status insert(const RID newRid,  const char* tuple);
+    // copy tuple into the table
+    Status insert(const char* tuple);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
-};
+    // first tuple whose join attribute matches the value at attrPtr,
+    // NULL if there is none
+    const char* lookup(const char* attrPtr);
+
+    // next tuple that matches the value of the last lookup, or NULL
+    const char* next();
 
+    // A batch of probes, a column of join attribute values: hashKeys
+    // normalizes and hashes values sel[0..n-1] of column into keys and
+    // hashes all at once, and probe looks up one of those keys as
+    // lookup does a value.
+    void hashKeys(const char* column, const int* sel, const int n,
+		  unsigned char* keys, unsigned int* hashes) const;
+    const char* probe(const unsigned char* key, const unsigned int hash);
+
+    // remove all tuples; the memory is kept for new ones
+    void clear();
+
+    int count() const { return cnt; }
+    const char* tuple(const int n) const { return entry(n) + joinAttr.attrLen; }
+
+    // bytes of memory the table takes
+    long memory() const;
+};
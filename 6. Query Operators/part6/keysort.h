@@ -0,0 +1,81 @@
+#ifndef KEYSORT_H
+#define KEYSORT_H
+
+#include "heapfile.h"
+
+
+// Sort keys are kept in normalized form: byte strings that compare
+// with memcmp exactly like the attribute values they were made from.
+//
+//   INTEGER  big-endian, with the sign bit flipped
+//   FLOAT    big-endian; the sign bit is flipped for positive values
+//            and all bits are flipped for negative ones
+//   STRING   the bytes after the terminating null are zeroed, so that
+//            memcmp agrees with the strncmp used by HeapFileScan
+
+
+// SORTREC is an in-memory sort record. It points to the normalized
+// sort attribute in a KeyArena and caches its first four bytes, so
+// that most comparisons never touch the key itself. The RID is used
+// for fetching the full record when it is needed.
+
+typedef struct {
+  RID rid;                              // record id of current record
+  unsigned int prefix;                  // first 4 key bytes, big-endian
+  int run;                              // sub-run of a replacement
+                                        // selection heap item
+  unsigned char* key;                   // normalized sort attribute
+} SORTREC;
+
+
+// A bump allocator for the keys of one sub-run. All keys are freed
+// at once by reset() when the run has been written.
+
+class KeyArena {
+ public:
+  KeyArena(int capacity);               // capacity in bytes
+  ~KeyArena();
+
+  unsigned char* alloc(int len)         // NULL if the arena is full
+  {
+    if (used + len > size) return NULL;
+    unsigned char* p = base + used;
+    used += len;
+    return p;
+  }
+  void reset() { used = 0; }
+
+ private:
+  unsigned char* base;
+  int size;
+  int used;
+};
+
+
+// convert an attribute value of the given type and length to its
+// normalized form in key (length bytes)
+void normalizeKey(const char* attr, int length, Datatype type,
+		  unsigned char* key);
+
+// first four bytes of a normalized key as an integer, 0-padded
+unsigned int keyPrefix(const unsigned char* key, int length);
+
+// Sort n records on their normalized keys. INTEGER and FLOAT keys
+// are radix sorted on the prefix. STRING keys are radix sorted on
+// the prefix too, and records with equal prefixes are then sorted on
+// the next four bytes, loaded into the prefix, and so on; small groups
+// are sorted by comparison. tmp must have room for n records. Records
+// with equal keys stay in the order of their keys in the arena.
+void sortKeys(SORTREC* recs, SORTREC* tmp, int n, int length,
+	      Datatype type);
+
+// Same result as sortKeys, computed by up to threads threads: each
+// sorts one chunk of the records, and the sorted chunks are then
+// merged in parallel, each thread producing one key range of the
+// output. Small inputs are sorted by the calling thread alone.
+void parallelSortKeys(SORTREC* recs, SORTREC* tmp, int n, int length,
+		      Datatype type, int threads);
+
+const int MAXSORTTHREADS = 16;          // upper limit on threads
+
+#endif
@@ -69,6 +69,12 @@ public:
 
     // returns reference to record with RID rid
     const Status getRecord(const RID & rid, Record & rec);
+
+    // returns pointers to the records after the one with RID curRid,
+    // at most max of them, and the RID of the last in lastRid;
+    // returns their number, 0 at the end of the page
+    const int nextRecords(const RID & curRid, const char* recs[],
+			  const int max, RID& lastRid) const;
 };
 
 #endif
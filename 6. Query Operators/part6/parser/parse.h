@@ -65,7 +65,9 @@ typedef enum {
     N_ATTRTYPE,
     N_VALUE,
     N_LIST,
-    N_ALIAS
+    N_ALIAS,
+    N_BOOLQUAL,
+    N_ORDERBY
 } NODEKIND;
 
 
@@ -82,6 +84,8 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *group;         // group by attribute or NULL
+	    struct node *order;         // order by node or NULL
 	} QUERY;
 
 	// insert node */
@@ -113,6 +117,9 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    int fillfactor;
+	    int bitmap;
+	    struct node *incllist;
 	} BUILD;
 
 	// drop node */
@@ -147,14 +154,30 @@ typedef struct node {
 	// join node */
 	struct {
 	    struct node *joinattr1;
-	    int op;
+	    int op;                     // RW_BETWEEN for a band join
 	    struct node *joinattr2;
+	    struct node *low;           // band join: joinattr1 between
+	    struct node *high;          // joinattr2 + low and joinattr2 + high
 	} JOIN;
 
+	// list of selections and joins connected by and/or */
+	struct {
+	    int op;                     // RW_AND or RW_OR
+	    struct node *quallist;
+	} BOOLQUAL;
+
+	// order by attribute and/or limit on the number of tuples */
+	struct {
+	    struct node *orderattr;     // NULL if only limited
+	    int desc;                   // 1 if largest value first
+	    int limit;                  // negative if no limit
+	} ORDERBY;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
 	    char *attrname;
+	    int aggr;                   // RW_COUNT, ..., RW_MAX or 0
 	} QUALATTR;
 
 	// primary attribute node */
@@ -212,12 +235,14 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *group,
+		 NODE *order);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets,
+		  int fillfactor, int bitmap, NODE *incllist);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
@@ -225,6 +250,9 @@ NODE *print_node(char *relname);
 NODE *help_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *band_node(NODE *joinattr1, NODE *joinattr2, NODE *low, NODE *high);
+NODE *boolqual_node(int op, NODE *quallist);
+NODE *orderby_node(NODE *orderattr, int desc, int limit);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -14,7 +14,7 @@ extern int yywrap();
 extern void reset_scanner();
 extern void quit();
 
-void yyerror(char *);
+void yyerror(const char *);
 
 extern char *yytext;                    // tokens in string format
 static NODE *parse_tree;                // root of parse tree
@@ -43,6 +43,9 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DELETE
 		RW_PRIMARY
 		RW_NUMBUCKETS
+		RW_FILLFACTOR
+		RW_BITMAP
+		RW_INCLUDE
 		RW_ALL
 		RW_FROM
 		RW_AS
@@ -51,6 +54,18 @@ static NODE *parse_tree;                // root of parse tree
 		RW_OR
 		RW_NOT
 		RW_VALUES	
+		RW_ORDER
+		RW_BY
+		RW_ASC
+		RW_DESC
+		RW_LIMIT
+		RW_BETWEEN
+		RW_GROUP
+		RW_COUNT
+		RW_SUM
+		RW_AVG
+		RW_MIN
+		RW_MAX
 		INT_TYPE
 		REAL_TYPE
 		CHAR_TYPE	
@@ -73,6 +88,9 @@ static NODE *parse_tree;                // root of parse tree
 		T_SHELL_CMD
 
 %type	<ival>	op
+		opt_desc
+		opt_limit
+		aggr
 
 %type	<sval>	opt_into_relname
 		opt_relname
@@ -95,10 +113,17 @@ static NODE *parse_tree;                // root of parse tree
 		quit
 		opt_primary_attr
 		opt_where
+		opt_group
+		opt_order
 		qual
+		qual_term
+		and_list
+		or_list
 		selection
 		join
+		band_offset
 		non_mt_qualattr_list
+		selattr
 		qualattr
 /*
 		non_mt_attrval_list
@@ -164,6 +189,7 @@ command
 
 query
 	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	  opt_group opt_order
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
@@ -176,8 +202,17 @@ query
 		  if ((where == NULL) && ($6 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
+		  else if ($7 &&
+			   !replace_alias_in_qualattr_list($5, list_node($7))) {
+		     $$ = NULL; //something wrong in group by attribute
+		  }
+		  else if ($8 && $8->u.ORDERBY.orderattr &&
+			   !replace_alias_in_qualattr_list($5,
+				list_node($8->u.ORDERBY.orderattr))) {
+		     $$ = NULL; //something wrong in order by attribute
+		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($3, qualattr_list, where, $7, $8);
 		  }
 		}
 	}
@@ -272,7 +307,28 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, 0, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	{
+		$$ = build_node($2, $4, $8, 0, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_FILLFACTOR T_EQ T_INT
+	{
+		$$ = build_node($2, $4, 0, $8, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_BITMAP
+	{
+		$$ = build_node($2, $4, 0, 0, 1, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_INCLUDE '(' attrib_list ')'
+	{
+		$$ = build_node($2, $4, 0, 0, 0, $8);
+	}
+	| RW_BUILD string '(' string ')' RW_INCLUDE '(' attrib_list ')'
+	  RW_FILLFACTOR T_EQ T_INT
+	{
+		$$ = build_node($2, $4, 0, $12, 0, $8);
 	}
 	;
 
@@ -367,11 +423,97 @@ opt_where
 	}
 	;
 
+opt_group
+	: RW_GROUP RW_BY qualattr
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_order
+	: RW_ORDER RW_BY qualattr opt_desc opt_limit
+	{
+		$$ = orderby_node($3, $4, $5);
+	}
+	| RW_LIMIT T_INT
+	{
+		$$ = orderby_node(NULL, 0, $2);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_desc
+	: RW_ASC
+	{
+		$$ = 0;
+	}
+	| RW_DESC
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 qual
+	: qual_term
+	| qual_term RW_AND and_list
+	{
+		$$ = boolqual_node(RW_AND, prepend($1, $3));
+	}
+	| qual_term RW_OR or_list
+	{
+		$$ = boolqual_node(RW_OR, prepend($1, $3));
+	}
+	;
+
+qual_term
 	: selection
 	| join
 	;
 
+and_list
+	: qual_term RW_AND and_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| qual_term
+	{
+		$$ = list_node($1);
+	}
+	;
+
+or_list
+	: qual_term RW_OR or_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| qual_term
+	{
+		$$ = list_node($1);
+	}
+	;
+
 selection
 	: qualattr op value
 	{
@@ -384,6 +526,49 @@ join
 	{
 		$$ = join_node($1, $2, $3);
 	}
+	| qualattr RW_BETWEEN qualattr band_offset RW_AND qualattr band_offset
+	{
+		// both bounds are offsets from the same attribute
+		char *r1 = $3->u.QUALATTR.relname;
+		char *r2 = $6->u.QUALATTR.relname;
+		if (strcmp($3->u.QUALATTR.attrname, $6->u.QUALATTR.attrname) ||
+		    (r1 != r2 && (r1 == NULL || r2 == NULL || strcmp(r1, r2)))) {
+			yyerror("both bounds of between must be on one attribute");
+			YYERROR;
+		}
+		$$ = band_node($1, $3, $4, $7);
+	}
+	;
+
+band_offset
+	: '+' T_INT
+	{
+		$$ = int_node($2);
+	}
+	| '-' T_INT
+	{
+		$$ = int_node(-$2);
+	}
+	| T_INT                         /* signed, as in b.y -5 */
+	{
+		$$ = int_node($1);
+	}
+	| '+' T_REAL
+	{
+		$$ = float_node($2);
+	}
+	| '-' T_REAL
+	{
+		$$ = float_node(-$2);
+	}
+	| T_REAL
+	{
+		$$ = float_node($1);
+	}
+	| nothing
+	{
+		$$ = int_node(0);
+	}
 	;
 
 non_mt_qualattr_list
@@ -391,16 +576,48 @@ non_mt_qualattr_list
 	{
 		$$ = $2;
 	}
-	| qualattr ',' non_mt_qualattr_list
+	| selattr ',' non_mt_qualattr_list
 	{
 		$$ = prepend($1, $3);
 	}
-	| qualattr
+	| selattr
 	{
 		$$ = list_node($1);
 	}
 	;
 
+selattr
+	: qualattr
+	| aggr '(' qualattr ')'
+	{
+		$3->u.QUALATTR.aggr = $1;
+		$$ = $3;
+	}
+	;
+
+aggr
+	: RW_COUNT
+	{
+		$$ = RW_COUNT;
+	}
+	| RW_SUM
+	{
+		$$ = RW_SUM;
+	}
+	| RW_AVG
+	{
+		$$ = RW_AVG;
+	}
+	| RW_MIN
+	{
+		$$ = RW_MIN;
+	}
+	| RW_MAX
+	{
+		$$ = RW_MAX;
+	}
+	;
+
 qualattr
 	: string '.' string
 	{
@@ -536,7 +753,7 @@ void parse(void)
 }
 
 
-void yyerror(char *s)
+void yyerror(const char *s)
 {
   puts(s);
 }
@@ -70,30 +70,45 @@ extern int yydebug;
     RW_DELETE = 271,               /* RW_DELETE  */
     RW_PRIMARY = 272,              /* RW_PRIMARY  */
     RW_NUMBUCKETS = 273,           /* RW_NUMBUCKETS  */
-    RW_ALL = 274,                  /* RW_ALL  */
-    RW_FROM = 275,                 /* RW_FROM  */
-    RW_AS = 276,                   /* RW_AS  */
-    RW_TABLE = 277,                /* RW_TABLE  */
-    RW_AND = 278,                  /* RW_AND  */
-    RW_OR = 279,                   /* RW_OR  */
-    RW_NOT = 280,                  /* RW_NOT  */
-    RW_VALUES = 281,               /* RW_VALUES  */
-    INT_TYPE = 282,                /* INT_TYPE  */
-    REAL_TYPE = 283,               /* REAL_TYPE  */
-    CHAR_TYPE = 284,               /* CHAR_TYPE  */
-    T_EQ = 285,                    /* T_EQ  */
-    T_LT = 286,                    /* T_LT  */
-    T_LE = 287,                    /* T_LE  */
-    T_GT = 288,                    /* T_GT  */
-    T_GE = 289,                    /* T_GE  */
-    T_NE = 290,                    /* T_NE  */
-    T_EOF = 291,                   /* T_EOF  */
-    NOTOKEN = 292,                 /* NOTOKEN  */
-    T_INT = 293,                   /* T_INT  */
-    T_REAL = 294,                  /* T_REAL  */
-    T_STRING = 295,                /* T_STRING  */
-    T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    RW_FILLFACTOR = 274,           /* RW_FILLFACTOR  */
+    RW_BITMAP = 275,               /* RW_BITMAP  */
+    RW_INCLUDE = 276,              /* RW_INCLUDE  */
+    RW_ALL = 277,                  /* RW_ALL  */
+    RW_FROM = 278,                 /* RW_FROM  */
+    RW_AS = 279,                   /* RW_AS  */
+    RW_TABLE = 280,                /* RW_TABLE  */
+    RW_AND = 281,                  /* RW_AND  */
+    RW_OR = 282,                   /* RW_OR  */
+    RW_NOT = 283,                  /* RW_NOT  */
+    RW_VALUES = 284,               /* RW_VALUES  */
+    RW_ORDER = 285,                /* RW_ORDER  */
+    RW_BY = 286,                   /* RW_BY  */
+    RW_ASC = 287,                  /* RW_ASC  */
+    RW_DESC = 288,                 /* RW_DESC  */
+    RW_LIMIT = 289,                /* RW_LIMIT  */
+    RW_BETWEEN = 290,              /* RW_BETWEEN  */
+    RW_GROUP = 291,                /* RW_GROUP  */
+    RW_COUNT = 292,                /* RW_COUNT  */
+    RW_SUM = 293,                  /* RW_SUM  */
+    RW_AVG = 294,                  /* RW_AVG  */
+    RW_MIN = 295,                  /* RW_MIN  */
+    RW_MAX = 296,                  /* RW_MAX  */
+    INT_TYPE = 297,                /* INT_TYPE  */
+    REAL_TYPE = 298,               /* REAL_TYPE  */
+    CHAR_TYPE = 299,               /* CHAR_TYPE  */
+    T_EQ = 300,                    /* T_EQ  */
+    T_LT = 301,                    /* T_LT  */
+    T_LE = 302,                    /* T_LE  */
+    T_GT = 303,                    /* T_GT  */
+    T_GE = 304,                    /* T_GE  */
+    T_NE = 305,                    /* T_NE  */
+    T_EOF = 306,                   /* T_EOF  */
+    NOTOKEN = 307,                 /* NOTOKEN  */
+    T_INT = 308,                   /* T_INT  */
+    T_REAL = 309,                  /* T_REAL  */
+    T_STRING = 310,                /* T_STRING  */
+    T_QSTRING = 311,               /* T_QSTRING  */
+    T_SHELL_CMD = 312              /* T_SHELL_CMD  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -118,30 +133,45 @@ extern int yydebug;
 #define RW_DELETE 271
 #define RW_PRIMARY 272
 #define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_FILLFACTOR 274
+#define RW_BITMAP 275
+#define RW_INCLUDE 276
+#define RW_ALL 277
+#define RW_FROM 278
+#define RW_AS 279
+#define RW_TABLE 280
+#define RW_AND 281
+#define RW_OR 282
+#define RW_NOT 283
+#define RW_VALUES 284
+#define RW_ORDER 285
+#define RW_BY 286
+#define RW_ASC 287
+#define RW_DESC 288
+#define RW_LIMIT 289
+#define RW_BETWEEN 290
+#define RW_GROUP 291
+#define RW_COUNT 292
+#define RW_SUM 293
+#define RW_AVG 294
+#define RW_MIN 295
+#define RW_MAX 296
+#define INT_TYPE 297
+#define REAL_TYPE 298
+#define CHAR_TYPE 299
+#define T_EQ 300
+#define T_LT 301
+#define T_LE 302
+#define T_GT 303
+#define T_GE 304
+#define T_NE 305
+#define T_EOF 306
+#define NOTOKEN 307
+#define T_INT 308
+#define T_REAL 309
+#define T_STRING 310
+#define T_QSTRING 311
+#define T_SHELL_CMD 312
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -154,7 +184,7 @@ union YYSTYPE
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 188 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
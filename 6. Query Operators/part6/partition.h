@@ -8,6 +8,17 @@
 //#define DEBUGPART
 
 
+// Directory of the partition files, with a trailing '/'; /tmp/ unless
+// minirel is told otherwise.
+
+extern string PartitionDir;
+
+
+// A Partition is written tuple at a time, or in radix mode: tuples
+// are read into memory chunks of memPages pages, grouped by partition
+// there with radix passes on up to threads threads, and each group
+// is appended to its partition file in one go.
+
 class Partition {
  public:
   Partition(HeapFileScan *rel,              // name of heap file to partition
@@ -17,6 +28,8 @@ class Partition {
 				 const int P),  
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
+	    const int memPages,          // radix mode if > 0
+	    const int threads,           // threads of radix passes
 	    Status &status);            // create partitions of file
   ~Partition();                         // destroy partitions
 
@@ -3,7 +3,37 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+// CostJoin chooses the method for each join with a cost model
+enum JoinType {NLJoin, SMJoin, HashJoin, TupleNLJoin, CostJoin};
+
+extern int HashJoinPages;               // memory of a hash join in pages
+
+// Cost model of the joins (join.C): the cost of comparing or hashing
+// a tuple, in pages, the pages an index probe reads before it gets to
+// the matching tuples, and the fraction of a relation an inequality
+// matches
+const double CPUCOST = 0.001;
+const double INDEXPROBE = 2;
+const double RANGEFRACTION = 1.0 / 3;
+
+// the operator with its operands swapped: a op b iff b flipOp(op) a
+const Operator flipOp(const Operator op);
+
+// true if an index on attrDesc can find the tuples that satisfy
+// attrDesc op value
+const bool usableIndex(const AttrDesc & attrDesc, const Operator op);
+
+// a value given as a string in the binary form of attribute attrDesc,
+// allocated with malloc
+char *makeFilter(const AttrDesc & attrDesc, const char *attrValue);
+
+// aggregate functions of the select list; NoAgg is a plain attribute
+enum AggFunc {NoAgg, CountAgg, SumAgg, AvgAgg, MinAgg, MaxAgg};
+
+// the attribute func of attrDesc produces, named like count_attr
+// (iterator.C)
+const Status aggregateAttr(const AggFunc func, const AttrDesc & attrDesc,
+                           AttrDesc & result);
 
 //
 // Prototypes for query layer functions
@@ -17,6 +47,14 @@ const Status QU_Select(const string & result,
 		       const Operator op, 
 		       const char *attrValue);
 
+const Status QU_MultiSelect(const string & result,
+			    const int projCnt,
+			    const attrInfo projNames[],
+			    const int predCnt,
+			    const attrInfo preds[],
+			    const Operator ops[],
+			    const bool conjunctive);
+
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
@@ -24,6 +62,48 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+const Status QU_Band_Join(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const attrInfo *attr1,
+			  const attrInfo *attr2,
+			  const char *low,
+			  const char *high);
+
+const Status QU_MultiJoin(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const int joinCnt,
+			  const attrInfo joinAttrs1[],
+			  const Operator joinOps[],
+			  const attrInfo joinAttrs2[],
+			  const int selCnt,
+			  const attrInfo selAttrs[],
+			  const Operator selOps[]);
+
+const Status QU_Query(const string & result,
+		      const int projCnt,
+		      const attrInfo projNames[],
+		      const AggFunc aggs[],
+		      const int joinCnt,
+		      const attrInfo joinAttrs1[],
+		      const Operator joinOps[],
+		      const attrInfo joinAttrs2[],
+		      const int selCnt,
+		      const attrInfo selAttrs[],
+		      const Operator selOps[],
+		      const bool conjunctive,
+		      const attrInfo *groupAttr,
+		      const int orderPos,
+		      const bool descending,
+		      const int limit);
+
+const Status QU_OrderBy(const string & result,
+			const string & relation,
+			const attrInfo *attr,
+			const bool descending,
+			const int limit);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
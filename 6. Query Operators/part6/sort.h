@@ -2,21 +2,35 @@
 #define SORT_H
 
 #include "heapfile.h"
+#include "keysort.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// How the source file is cut into sorted sub-runs:
+//
+//   FIXEDRUNS      runs of maxItems records, each sorted in memory
+//   REPLACESELECT  replacement selection through a heap of maxItems
+//                  records; runs are about twice as long on random
+//                  input, and sorted input gives a single run
+//   TUPLERUNS      like FIXEDRUNS, but whole tuples are copied into
+//                  memory, so runs are written without reading the
+//                  source file again
+//
+// FIXEDRUNS and REPLACESELECT keep only the sort attribute and RID
+// of each record in memory and fetch the record by RID when the run
+// is written, which is a random read per record.
 
-typedef struct {
-  RID rid;                              // record id of current record
-  char* field;                          // pointer to field
-  int length;                           // length of field
-} SORTREC;
+enum RunGen { FIXEDRUNS, REPLACESELECT, TUPLERUNS };
+
+
+// Number of threads that sort a FIXEDRUNS or TUPLERUNS sub-run in
+// memory (see parallelSortKeys). Reading the source, writing runs,
+// and merging go through the buffer manager and stay on the calling
+// thread. Hash joins partition with as many threads (Partition).
+
+extern int SortThreads;
 
 
 class SortedFile {
@@ -24,18 +38,20 @@ class SortedFile {
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, RunGen runGen,
+	     bool descending, Status& status);
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
   Status gotoMark();                    // go to last recorded spot
   ~SortedFile();                        // destroy temporary structures / files
 
- private:
-  Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
-  Status startScans();                  // start a scan on each sorted run
+  int getRunCnt() const { return runs.size(); }  // # of sorted sub-runs
+  bool isPresorted() const { return presorted; } // source read as is?
+  int getMergeCnt() const { return mergeCnt; }   // # of merges before
+                                                 // the final one
 
+ private:
   typedef struct {
     string name;                        // name of run file
     HeapFileScan* inFile;               // ptr to input file
@@ -44,19 +60,52 @@ class SortedFile {
     Record rec;
     RID rid;                            // RID of current record of run
     RID mark;
+    int recCnt;                         // # of records in run
+    bool source;                        // run is the source file itself
   } RUN;
 
+  Status sortFile();                    // split source file into sub-runs
+  Status checkOrder(bool & inOrder);    // is source sorted already?
+  void makeKey(const char* attr, unsigned char* key);  // sort key of attr
+  Status generateRun(int numItems);     // generate one sub-run of file
+  Status replacementSelect();           // generate all sub-runs by
+                                        // replacement selection
+  Status tupleRuns();                   // ... from whole tuples
+  Status openRun(RUN & run);            // create file of a new sub-run
+  Status mergeRuns();                   // merge until runs fit in buffer
+  Status mergeShortest(int k);          // merge k shortest runs into one
+  Status startScans();                  // start a scan on each sorted run
+  Status fetchRun(int r);               // read next record of run r
+  bool beats(int r1, int r2);           // run r1's record comes first?
+  void buildTree();                     // play the whole tournament
+  void replay(int r);                   // replay the path of run r
+
   vector<RUN> runs;                   // holds info about each sub-run
 
+  // Loser tree over the runs: losers[0] is the run with the smallest
+  // current record, losers[n] for 0 < n < runs.size() the run that
+  // lost the match at internal node n. The runs are the leaves
+  // runs.size() .. 2 * runs.size() - 1 of the tree.
+
+  vector<int> losers;
+  bool treeValid;                     // false if tree must be rebuilt
+
   HeapFile* hfile;                   // source file to sort
   HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
+  bool descending;                      // largest record first?
+  RunGen runGen;                        // how sub-runs are generated
 
   SORTREC* buffer;                      // in-memory sort buffer
+  SORTREC* tmpBuffer;                   // scratch space for radix sort
+  KeyArena* arena;                      // normalized keys of buffer
   int maxItems;                         // max. # of items/tuples in buffer
+  int runSeq;                           // # of run files created
+  int mergeCnt;                         // # of intermediate merges
+  bool presorted;                       // true if source was in order
   int numItems;                         // current # of items in buffer
 };
 
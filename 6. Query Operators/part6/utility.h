@@ -27,6 +27,17 @@ const Status UT_Load(const string & relation,
 
 const Status UT_Print(string relation);
 
+const Status UT_BuildIndex(const string & relation,
+			   const string & attrName,
+			   const int nbuckets,
+			   const int fillFactor,
+			   const bool bitmap,
+			   const int inclCnt,
+			   const string incl[]);
+
+const Status UT_DropIndex(const string & relation,
+			  const string & attrName);
+
 void   UT_Quit(void);
 
 #endif